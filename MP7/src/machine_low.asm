@@ -15,4 +15,16 @@ global _get_EFLAGS
 _get_EFLAGS:
 	pushfd			; push eflags
 	pop	eax		; pop contents into eax
-	ret
\ No newline at end of file
+	ret
+
+; ----------------------------------------------------------------------
+; read_TSC()
+; 
+; Returns value of the time-stamp counter in edx:eax. 
+;
+; ----------------------------------------------------------------------
+global _read_TSC
+; this function is exported.
+_read_TSC:
+	rdtsc			; edx:eax = cycles since reset
+	ret